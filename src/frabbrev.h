@@ -0,0 +1,87 @@
+/************************************************************************/
+/*									*/
+/*  FramepaC  -- frame manipulation in C++				*/
+/*  Version 2.01							*/
+/*	by Ralf Brown <ralf@cs.cmu.edu>					*/
+/*									*/
+/*  File frabbrev.h		hashed abbreviation lookup		*/
+/*  LastEdit: 08nov2015							*/
+/*									*/
+/*  (c) Copyright 2015 Ralf Brown/Carnegie Mellon University		*/
+/*	This program is free software; you can redistribute it and/or	*/
+/*	modify it under the terms of the GNU Lesser General Public 	*/
+/*	License as published by the Free Software Foundation, 		*/
+/*	version 3.							*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU Lesser General Public License for more 	*/
+/*	details.							*/
+/*									*/
+/*	You should have received a copy of the GNU Lesser General	*/
+/*	Public License (file COPYING) and General Public License (file	*/
+/*	GPL.txt) along with this program.  If not, see			*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/************************************************************************/
+
+
+#ifndef __FRABBREV_H_INCLUDED
+#define __FRABBREV_H_INCLUDED
+
+#include <stdint.h>
+#include "frcommon.h"
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// an open-addressed hash set of abbreviations, used in place of a linear
+//   scan over the abbreviation list for each candidate word.  The set
+//   stores pointers to the caller's strings (which must remain valid for
+//   the lifetime of the set) together with their lengths and hash values,
+//   so that most non-matching probes are rejected without touching the
+//   strings themselves.  Strings of different character widths compare
+//   equal if they contain the same sequence of characters, just as
+//   FrString::operator== does.
+
+class FrAbbreviationSet
+   {
+   private:
+      struct Entry
+	 {
+	 const void *m_string ;
+	 uint32_t    m_length ;
+	 uint32_t    m_hash ;
+	 int	     m_width ;
+	 } ;
+      Entry  *m_entries ;
+      size_t  m_capacity ;		// always a power of two
+      size_t  m_count ;
+   public:
+      FrAbbreviationSet(size_t expected_size) ;
+      ~FrAbbreviationSet() ;
+
+      // accessors
+      bool OK() const { return m_entries != 0 ; }
+      size_t size() const { return m_count ; }
+      bool contains(const void *str, size_t len, int width = 1) const ;
+
+      // manipulators
+      bool add(const void *str, size_t len, int width = 1) ;
+
+      static uint32_t hash(const void *str, size_t len, int width) ;
+   } ;
+
+/************************************************************************/
+/*	Procedural interface						*/
+/************************************************************************/
+
+// get the hash set built for an abbreviation list by FrLoadAbbreviationList
+//   or FrIndexAbbreviationList, or 0 if the list has not been indexed
+const FrAbbreviationSet *FrAbbreviationIndex(char const * const *abbrevs) ;
+
+#endif /* !__FRABBREV_H_INCLUDED */
+
+// end of file frabbrev.h //
@@ -86,6 +86,7 @@ class FrBoundedPriQueue : public FrObject
 
       // accessors
       size_t queueLength() const { return q_tail - q_head ; }
+      size_t capacity() const { return q_size ; }
       const FrObject *first() const
 	  { return (q_tail > q_head) ? entries[q_head] : 0 ; }
       const FrObject *first(double &priority) const
@@ -367,6 +367,74 @@ class FrWordIDList
       bool full() const { return m_elts_used >= elts_per_buffer ; }
    } ;
 
+//----------------------------------------------------------------------
+// streaming conversion of raw text into the word-ID array consumed by
+//   FrBWTIndex::makeIndex, without going through the symbol table or
+//   FrWordIDList.  Text is split into chunks at line boundaries, the
+//   chunks are tokenized (with the same rules as FrTokenizeString) in
+//   parallel, each against its own private vocabulary, and the private
+//   vocabularies are then merged in input order, so that IDs are assigned
+//   in order of first occurrence exactly as FrCvtWord2WordID would.  Each
+//   line containing at least one word forms one record; unless 'eor' is
+//   ~0, record N is terminated by the value eor+N.
+//   The IDs are accumulated in memory or, after writeTo(), written to a
+//   file in native byte order as each batch of chunks completes.
+
+class FrWordIDStream
+   {
+   private:
+      class FrWordIDMap *m_vocab ;	// global word -> ID mapping
+      class FrWordIDChunk *m_chunks ;	// per-job tokenizing state
+      class FrThreadPool *m_tpool ;
+      FILE *m_outfp ;			// if set, write IDs here
+      uint32_t *m_IDs ;			// IDs collected in memory
+      size_t m_numIDs ;
+      size_t m_IDs_alloc ;
+      size_t m_totalIDs ;		// IDs emitted, incl. written to file
+      uint32_t *m_xlat ;		// chunk-local to global ID mapping
+      size_t m_xlat_alloc ;
+      char *m_buffer ;			// text not yet converted
+      size_t m_buffer_len ;
+      size_t m_buffer_alloc ;
+      size_t m_numchunks ;		// jobs per batch
+      size_t m_queued ;			// jobs in current batch
+      size_t m_chunksize ;		// bytes of text per job
+      size_t m_numrecords ;
+      uint32_t m_eor ;
+      FrCharEncoding m_encoding ;
+      bool m_uppercase ;
+      bool m_good ;
+   private:
+      bool bufferText(const char *text, size_t length) ;
+      size_t convert(const char *text, size_t length, bool final) ;
+      void queueChunk(const char *text, size_t length) ;
+      bool runBatch() ;
+      bool mergeChunk(FrWordIDChunk *chunk) ;
+      bool emit(const uint32_t *IDs, size_t count) ;
+   public:
+      FrWordIDStream(uint32_t eor = (uint32_t)~0,
+		     size_t num_threads = 0, bool force_uppercase = false,
+		     FrCharEncoding enc = FrChEnc_UTF8) ;
+      ~FrWordIDStream() ;
+
+      // manipulators
+      bool writeTo(FILE *fp) ;
+      void setChunkSize(size_t bytes) ;
+      bool addText(const char *text, size_t length) ;
+      bool addFile(const char *filename) ;
+      bool finish() ;			// convert any remaining text
+      uint32_t *releaseIDs(size_t &num_IDs) ; // caller must FrFree result
+
+      // accessors
+      bool good() const { return m_good ; }
+      size_t numIDs() const { return m_totalIDs ; }
+      size_t numRecords() const { return m_numrecords ; }
+      size_t vocabularySize() const ;
+      const char *word(uint32_t ID) const ;
+      const uint32_t *IDs() const { return m_IDs ; }
+      FrVocabulary *makeVocabulary() const ;
+   } ;
+
 //----------------------------------------------------------------------
 
 class FrNGramHistory
@@ -122,8 +122,7 @@ inline void FrStoreShort(int value, void *buffer)
 #elif defined(__GNUC__) && defined(__386__)
 #define FrStoreShort(value, location) \
    { uint16_t *_zz_loc = (uint16_t*)(location) ;  \
-     __asm__ ("xchg %%ah,%%al\n\t"  \
-	      "movw %%ax,%0" : "=g" (*_zz_loc) : "a" (value)) ; }
+     __asm__ ("xchg %h0,%b0" : "=Q" (*_zz_loc) : "0" ((uint16_t)(value))) ; }
 
 #elif defined(_MSC_VER) && _M_IX86 >= 300
 inline void FrStoreShort(int value, void *buffer)
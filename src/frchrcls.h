@@ -0,0 +1,179 @@
+/************************************************************************/
+/*									*/
+/*  FramepaC  -- frame manipulation in C++				*/
+/*  Version 2.01							*/
+/*	by Ralf Brown <ralf@cs.cmu.edu>					*/
+/*									*/
+/*  File frchrcls.h		vectorized character-class scanning	*/
+/*  LastEdit: 08nov2015							*/
+/*									*/
+/*  (c) Copyright 2015 Ralf Brown/Carnegie Mellon University		*/
+/*	This program is free software; you can redistribute it and/or	*/
+/*	modify it under the terms of the GNU Lesser General Public 	*/
+/*	License as published by the Free Software Foundation, 		*/
+/*	version 3.							*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU Lesser General Public License for more 	*/
+/*	details.							*/
+/*									*/
+/*	You should have received a copy of the GNU Lesser General	*/
+/*	Public License (file COPYING) and General Public License (file	*/
+/*	GPL.txt) along with this program.  If not, see			*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/************************************************************************/
+
+#ifndef __FRCHRCLS_H_INCLUDED
+#define __FRCHRCLS_H_INCLUDED
+
+#include <string.h>
+#include "frcommon.h"
+
+#if defined(__GNUC__) && defined(__AVX2__)
+#  include <immintrin.h>
+#  define FrSIMD_SCAN_WIDTH 32
+#elif defined(__GNUC__) && defined(__SSSE3__)
+#  include <tmmintrin.h>
+#  define FrSIMD_SCAN_WIDTH 16
+#endif
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// an arbitrary set of byte values, stored so that membership can be tested
+//   for a whole vector of bytes at once with two table lookups (PSHUFB):
+//   the low nibble of a byte selects a row, which holds a bitmask of the
+//   high nibbles (0-7 in the first table, 8-15 in the second) in the set.
+//   Without SSSE3, the scanning functions fall back on byte-at-a-time tests
+//   which give identical results.
+
+class FrCharClassSet
+   {
+   private:
+      unsigned char m_rows[2][16] ;
+   public:
+      FrCharClassSet() { memset(m_rows,'\0',sizeof(m_rows)) ; }
+      FrCharClassSet(const char *table) ;	 // 256 entries, nonzero=member
+      FrCharClassSet(const unsigned char *table) ;
+
+      void add(unsigned char c)
+	 { m_rows[c >> 7][c & 15] |= (unsigned char)(1 << ((c >> 4) & 7)) ; }
+      bool contains(unsigned char c) const
+	 { return ((m_rows[c >> 7][c & 15] >> ((c >> 4) & 7)) & 1) != 0 ; }
+
+#ifdef FrSIMD_SCAN_WIDTH
+      // bitmask with bit N set if s[N] is in the set, for the
+      //   FrSIMD_SCAN_WIDTH bytes starting at 's'
+      uint32_t matches(const char *s) const ;
+#endif /* FrSIMD_SCAN_WIDTH */
+
+      // return the position of the first byte in s[0..len-1] which is in
+      //   the set, or 'len' if there is none
+      size_t scan(const char *s, size_t len) const ;
+   } ;
+
+/************************************************************************/
+/*	Inline methods							*/
+/************************************************************************/
+
+inline FrCharClassSet::FrCharClassSet(const char *table)
+{
+   memset(m_rows,'\0',sizeof(m_rows)) ;
+   for (unsigned c = 0 ; c <= 0xFF ; c++)
+      {
+      if (table[c])
+	 add((unsigned char)c) ;
+      }
+   return ;
+}
+
+//----------------------------------------------------------------------
+
+inline FrCharClassSet::FrCharClassSet(const unsigned char *table)
+{
+   memset(m_rows,'\0',sizeof(m_rows)) ;
+   for (unsigned c = 0 ; c <= 0xFF ; c++)
+      {
+      if (table[c])
+	 add((unsigned char)c) ;
+      }
+   return ;
+}
+
+//----------------------------------------------------------------------
+
+#if FrSIMD_SCAN_WIDTH == 32
+
+inline uint32_t FrCharClassSet::matches(const char *s) const
+{
+   const __m256i lonib = _mm256_set1_epi8(0x0F) ;
+   const __m256i bitpos = _mm256_setr_epi8(1,2,4,8,16,32,64,(char)128,
+					   1,2,4,8,16,32,64,(char)128,
+					   1,2,4,8,16,32,64,(char)128,
+					   1,2,4,8,16,32,64,(char)128) ;
+   __m256i rows0 = _mm256_broadcastsi128_si256(
+			_mm_loadu_si128((const __m128i*)m_rows[0])) ;
+   __m256i rows1 = _mm256_broadcastsi128_si256(
+			_mm_loadu_si128((const __m128i*)m_rows[1])) ;
+   __m256i bytes = _mm256_loadu_si256((const __m256i*)s) ;
+   __m256i lo = _mm256_and_si256(bytes,lonib) ;
+   __m256i hi = _mm256_and_si256(_mm256_srli_epi16(bytes,4),lonib) ;
+   __m256i upper = _mm256_cmpgt_epi8(hi,_mm256_set1_epi8(7)) ;
+   __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(rows0,lo),
+				    _mm256_shuffle_epi8(rows1,lo),upper) ;
+   __m256i bit = _mm256_shuffle_epi8(bitpos,hi) ;
+   __m256i hit = _mm256_cmpeq_epi8(_mm256_and_si256(row,bit),bit) ;
+   return (uint32_t)_mm256_movemask_epi8(hit) ;
+}
+
+#elif FrSIMD_SCAN_WIDTH == 16
+
+inline uint32_t FrCharClassSet::matches(const char *s) const
+{
+   const __m128i lonib = _mm_set1_epi8(0x0F) ;
+   const __m128i bitpos = _mm_setr_epi8(1,2,4,8,16,32,64,(char)128,
+					1,2,4,8,16,32,64,(char)128) ;
+   __m128i rows0 = _mm_loadu_si128((const __m128i*)m_rows[0]) ;
+   __m128i rows1 = _mm_loadu_si128((const __m128i*)m_rows[1]) ;
+   __m128i bytes = _mm_loadu_si128((const __m128i*)s) ;
+   __m128i lo = _mm_and_si128(bytes,lonib) ;
+   __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes,4),lonib) ;
+   __m128i upper = _mm_cmpgt_epi8(hi,_mm_set1_epi8(7)) ;
+   __m128i row = _mm_or_si128(
+		    _mm_andnot_si128(upper,_mm_shuffle_epi8(rows0,lo)),
+		    _mm_and_si128(upper,_mm_shuffle_epi8(rows1,lo))) ;
+   __m128i bit = _mm_shuffle_epi8(bitpos,hi) ;
+   __m128i hit = _mm_cmpeq_epi8(_mm_and_si128(row,bit),bit) ;
+   return (uint32_t)_mm_movemask_epi8(hit) ;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+
+inline size_t FrCharClassSet::scan(const char *s, size_t len) const
+{
+   size_t pos = 0 ;
+#ifdef FrSIMD_SCAN_WIDTH
+   for ( ; pos + FrSIMD_SCAN_WIDTH <= len ; pos += FrSIMD_SCAN_WIDTH)
+      {
+      uint32_t hits = matches(s + pos) ;
+      if (hits)
+	 return pos + __builtin_ctz(hits) ;
+      }
+#endif /* FrSIMD_SCAN_WIDTH */
+   for ( ; pos < len ; pos++)
+      {
+      if (contains((unsigned char)s[pos]))
+	 break ;
+      }
+   return pos ;
+}
+
+#endif /* !__FRCHRCLS_H_INCLUDED */
+
+// end of file frchrcls.h //
@@ -112,6 +112,10 @@ enum FrClusteringRep
 //          when deciding whether to maintain a centroid for each cluster
 //       2. only FrCR_CENTROID is meaningful for FrCM_KMEANS (by definition
 //	    of the algorithm)
+//	 3. k-means only prunes similarity computations via the triangle
+//	    inequality for the metric measures FrCM_COSINE (angular distance),
+//	    FrCM_EUCLIDEAN, and FrCM_MANHATTAN; other measures always run
+//	    full Lloyd iterations
 // NOTE2: if any of the above enums changes, be sure to update checks in
 //    FrClusteringParameters ctor
 
@@ -159,12 +163,14 @@ class FrClusteringParameters
       size_t backoff_stepsize ;
       size_t cache_size ;		// number of nearest neighbors to cache
       size_t num_threads ;
+      size_t minibatch_size ;		// for mini-batch k-means (0 = off)
       FrClusteringMethod clus_method ;
       FrClusteringRep clus_rep ;
       FrClusteringMeasure sim_measure ;
       bool sum_cluster_sizes ;
       bool hard_cluster_limit ;
       bool ignore_beyond_cluster_limit ;
+      bool bound_pruning ;		// k-means triangle-inequality pruning
    public:
       FrClusteringParameters() ;
       FrClusteringParameters(FrClusteringMethod meth,
@@ -182,6 +188,8 @@ class FrClusteringParameters
       void numThreads(size_t thr) { num_threads = thr ; }
       void desiredClusters(size_t num) { desired_clusters = num ; }
       void maxIterations(size_t iter) { max_iterations = iter ; }
+      void miniBatchSize(size_t size) { minibatch_size = size ; }
+      void boundPruning(bool prune) { bound_pruning = prune ; }
       void backoffStep(size_t step) ;
       void cacheSize(size_t c) { cache_size = c ; }
       void hardClusterLimit(bool hard) { hard_cluster_limit = hard ; }
@@ -219,6 +227,8 @@ class FrClusteringParameters
       double beta() const { return m_beta ; }
       size_t desiredClusters() const { return desired_clusters ; }
       size_t maxIterations() const { return max_iterations ; }
+      size_t miniBatchSize() const { return minibatch_size ; }
+      bool boundPruning() const { return bound_pruning ; }
       size_t backoffStep() const { return backoff_stepsize ; }
       size_t cacheSize() const { return cache_size ; }
       bool sumSizes() const { return sum_cluster_sizes ||
@@ -251,6 +261,78 @@ FrList *FrClusterVectors(const FrList *vectors,
 //  processed, make one final call with vectors==0 to force a cleanup.
 // Note: results will be unpredictable if any parameters other than 'vectors'
 //  are changed between calls.
+// For agglomerative clustering, the state also records the sequence of
+//  merges, so that it may be checkpointed and later re-cut (see below).
+
+bool FrSaveClusteringState(const void *clustering_state, const char *filename) ;
+void *FrLoadClusteringState(const char *filename, const FrList *vectors) ;
+// write a compact binary checkpoint of the cluster membership, centroids,
+//  nearest-neighbor caches, and merge history, and read it back in.  The
+//  members are stored by key, so 'vectors' must contain term vectors with
+//  the same keys as the ones which were clustered.  The loaded state may be
+//  passed to any function accepting a clustering_state, including a final
+//  cleanup call to FrClusterVectors.
+size_t FrRecutClusters(void *clustering_state, double threshold,
+		       size_t desired_clusters = 0) ;
+// rebuild the clusters by replaying the recorded merges from the initial
+//  clusters, stopping at the first merge whose similarity is below
+//  'threshold' or once only 'desired_clusters' remain; returns the number
+//  of clusters.  Nearest-neighbor information is not retained.
+
+//----------------------------------------------------------------------
+// online clustering of an unbounded stream of term vectors, in bounded
+//   memory.  Each incoming vector is absorbed into the most similar of a
+//   limited number of summaries (BIRCH-style clustering features: the mean
+//   of the absorbed vectors plus their count), or starts a new summary if
+//   none is similar enough.  Whenever the number of summaries exceeds the
+//   limit, the most similar pairs are merged and the absorption threshold
+//   is relaxed accordingly.  The vectors passed to add() are not retained.
+
+class FrClusterStream
+   {
+   private:
+      const FrClusteringParameters *m_params ;
+      FrTermVector **m_summaries ;	// mean of absorbed vectors
+      size_t	    *m_counts ;		// number of vectors absorbed by each
+      size_t	     m_numsummaries ;
+      size_t	     m_maxsummaries ;
+      size_t	     m_numvectors ;	// total vectors seen
+      double	     m_threshold ;	// current absorption threshold
+   private:
+      void absorb(size_t index, const FrTermVector *tv) ;
+      void compact() ;
+   public:
+      FrClusterStream(const FrClusteringParameters *params,
+		      size_t max_summaries = 0) ;
+      ~FrClusterStream() ;
+
+      // modifiers
+      bool add(const FrTermVector *tv) ;
+      size_t add(const FrList *vectors) ;  // returns number of vectors added
+      void clear() ;
+
+      // accessors
+      bool OK() const { return m_summaries != nullptr && m_counts != nullptr ; }
+      size_t vectorsSeen() const { return m_numvectors ; }
+      size_t numSummaries() const { return m_numsummaries ; }
+      size_t maxSummaries() const { return m_maxsummaries ; }
+      double threshold() const { return m_threshold ; }
+      const FrTermVector *summary(size_t N) const
+	 { return N < m_numsummaries ? m_summaries[N] : nullptr ; }
+      size_t summaryCount(size_t N) const
+	 { return N < m_numsummaries ? m_counts[N] : 0 ; }
+
+      size_t nearestSummary(const FrTermVector *tv, double &sim) const ;
+      // returns (size_t)~0 if no summary is eligible
+      FrList *clusters(bool exclude_singletons = true,
+		       bool run_verbosely = false) const ;
+      // cluster the current summaries using the stream's clustering
+      //   parameters, and return the result in the same format as
+      //   FrClusterVectors.  The members of each cluster are copies of the
+      //   summaries, with vectorFreq() set to the number of input vectors
+      //   each one absorbed and key() set to the key of the first of those
+      //   vectors; free the result with FrEraseClusterList(list,true).
+   } ;
 
 double FrClusterSimilarity(const FrList *cluster1,const FrList *cluster2,
 			   const FrClusteringParameters *params,
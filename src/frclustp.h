@@ -85,6 +85,89 @@ inline bool conflicting_seed_cluster(const FrTermVector *tv1,
    return params->conflict(tv1,tv2) ;
 }
 
+/************************************************************************/
+/*	Clustering state passed between calls				*/
+/************************************************************************/
+
+class Fr_ClusterMerge
+   {
+   public:
+      FrSymbol *kept ;			// cluster which absorbed the other
+      FrSymbol *absorbed ;
+      double    similarity ;
+   } ;
+
+//----------------------------------------------------------------------
+// the object behind the opaque 'clustering_state' of FrClusterVectors:
+//   the clusters themselves plus the partial dendrogram built by
+//   agglomerative clustering (the initial cluster of each vector and the
+//   sequence of merges), which permits re-cutting at another threshold
+
+class Fr_ClusteringState
+   {
+   public:
+      FrSymHashTable  *clusters ;	// name -> (centroid size members...)
+      FrSymHashTable  *leaves ;		// vector key -> initial cluster name
+      Fr_ClusterMerge *merges ;
+      size_t           num_merges ;	// merges applied to 'clusters'
+      size_t           total_merges ;	// merges recorded (>= num_merges)
+      size_t           alloc_merges ;
+      FrClusteringRep  rep ;
+   public:
+      Fr_ClusteringState(FrSymHashTable *cl, FrClusteringRep r) ;
+      ~Fr_ClusteringState() ;
+
+      bool addMerge(FrSymbol *kept, FrSymbol *absorbed, double sim) ;
+      void addLeaves(FrSymHashTable *map) ;
+      void freeClusters() ;
+   } ;
+
+/************************************************************************/
+/*	Incremental cluster-similarity cache				*/
+/************************************************************************/
+
+// Holds the sums of member-by-member similarities between pairs of
+//   clusters (identified by their centroids) for the group-average and
+//   RMS cluster representatives.  When two clusters are merged, the sums
+//   for the new cluster are obtained by adding together the sums for the
+//   two old clusters (the Lance-Williams update), so that comparing the
+//   merged cluster against every other cluster need not revisit all the
+//   member pairs.
+
+class Fr_ClusterSimCache
+   {
+   public:
+      class Row ;
+      class RowIndex ;
+   private:
+      RowIndex *m_rows ;	// centroid -> table of partner sums
+      size_t   m_entries ;	// number of sums currently cached
+      size_t   m_maxentries ;
+      size_t   m_hits ;
+      size_t   m_misses ;
+      bool     m_symmetric ;	// can sums be combined in both positions?
+   protected:
+      Row *row(const FrTermVector *centroid, bool create) ;
+   public:
+      Fr_ClusterSimCache(FrClusteringRep rep, size_t max_entries = 0) ;
+      ~Fr_ClusterSimCache() ;
+      static bool applicable(const FrClusteringParameters *params) ;
+
+      // accessors
+      bool OK() const { return m_rows != 0 ; }
+      size_t entries() const { return m_entries ; }
+      size_t hits() const { return m_hits ; }
+      size_t misses() const { return m_misses ; }
+      bool lookup(const FrTermVector *c1, const FrTermVector *c2,
+		  double &sum) ;
+
+      // manipulators
+      void store(const FrTermVector *c1, const FrTermVector *c2,
+		 double sum) ;
+      void merge(const FrTermVector *kept, const FrTermVector *removed) ;
+      void clear() ;
+   } ;
+
 /************************************************************************/
 /************************************************************************/
 
@@ -119,7 +202,8 @@ double Fr__cluster_similarity(const FrList *cluster1,
 			      const FrClusteringParameters *params,
 			      // allow a user-similarity function to short-circuit its eval if the score
 			      //   will be less than the best so far
-			      double best_sim = -1.0) ;
+			      double best_sim = -1.0,
+			      Fr_ClusterSimCache *cache = nullptr) ;
 
 void Fr__cluster_kmeans(const FrList *vectors, FrSymHashTable *clusters,
 			const FrClusteringParameters *params,
@@ -140,5 +224,9 @@ void Fr__cluster_growseed(const FrList *vectors, FrSymHashTable *clusters,
 void Fr__cluster_spectral(const FrList *vectors, FrSymHashTable *clusters,
 			  const FrClusteringParameters *params,
 			  bool run_verbosely = false) ;
+void Fr__cluster_spectral_sparse(const FrList *vectors,
+				 FrSymHashTable *clusters,
+				 const FrClusteringParameters *params,
+				 bool run_verbosely = false) ;
 
 // end of file frclustp.h //
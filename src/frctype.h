@@ -38,6 +38,7 @@ extern const unsigned char FramepaC_toupper_table[] ;
 #define Fr_toupper(c) (FramepaC_toupper_table[(unsigned char)c])
 extern const unsigned char FramepaC_tolower_table[] ;
 #define Fr_tolower(c) (FramepaC_tolower_table[(unsigned char)c])
+extern const unsigned char FramepaC_EUC_toupper_table[] ;
 extern const unsigned char FramepaC_ispunct_table[] ;
 #define Fr_ispunct(c) (FramepaC_ispunct_table[(unsigned char)c])
 extern const unsigned char FramepaC_isdigit_table[] ;
@@ -45,20 +45,35 @@
 /**********************************************************************/
 /**********************************************************************/
 
+class FrThreadPool ;
+class HashEntryVFrame ;
+struct VFrameReadBatch ;
+
 /**********************************************************************/
 /*      Declaration of class VFrameInfoFile                           */
 /**********************************************************************/
 
 class VFrameInfoFile : public VFrameInfo
    {
-   private:
+   protected:
       DBFILE *db ;
 #ifdef FrFRAME_ID
       FrameIdentDirectory *frame_IDs ;
 #endif /* FrFRAME_ID */
+      // asynchronous reads, which are serviced by a small pool of I/O
+      //   threads and consumed by retrieveFrame()
+      mutable FrThreadPool *io_pool ;
+      mutable VFrameReadBatch *read_batches ;
+   protected:
+      bool startReads(HashEntryVFrame **entries, int **done,
+		      size_t count) const ;
+      VFrame *finishRead(HashEntryVFrame *entry) const ;
+      void discardReads() const ;
+      int advanceCompaction(bool wait) ;
    public:
       VFrameInfoFile(const char *file, bool transactions = false,
-		     bool force_create = true, const char *password = 0) ;
+		     bool force_create = true, const char *password = 0,
+		     bool binary_frames = false) ;
       virtual ~VFrameInfoFile() ;
       virtual BackingStore backingStoreType() const ;
       virtual int backstorePresent() const ;
@@ -100,6 +115,32 @@ class VFrameInfoFile : public VFrameInfo
       virtual bool setDBUserData(DBUserData *user_data) ;
       virtual FrList *availableDatabases() const ;
       virtual int prefetchFrames(FrList *frames) ;
+      virtual bool groupCommit(bool enable, long window) ;
+      virtual int compactDatabase(int generations, bool wait) ;
+      virtual FrList *framesMatching(const FrList *query) const ;
+   } ;
+
+/**********************************************************************/
+/*      Declaration of class VFrameInfoMapped                         */
+/**********************************************************************/
+
+// a disk database in the binary frame format, whose records are read
+//   straight out of a memory mapping of the file instead of being copied
+//   into a buffer first; updates go through VFrameInfoFile unchanged
+
+class VFrameInfoMapped : public VFrameInfoFile
+   {
+   public:
+      VFrameInfoMapped(const char *file, bool transactions = false,
+		       bool force_create = true, const char *password = 0) ;
+      virtual ~VFrameInfoMapped() ;
+      virtual BackingStore backingStoreType() const ;
+      virtual VFrame *retrieveFrame(const FrSymbol *name) const ;
+      virtual VFrame *retrieveFrameAsync(const FrSymbol *name,
+					 int &done) const ;
+      virtual VFrame *retrieveOldFrame(FrSymbol *name, int generation)
+		const ;
+      virtual int prefetchFrames(FrList *frames) ;
    } ;
 
 #endif /* !__FRDATFIL_H_INCLUDED */
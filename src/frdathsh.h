@@ -38,6 +38,8 @@
 #  pragma interface
 #endif
 
+struct VFramePendingRead ;
+
 /**********************************************************************/
 /*	Definition of class HashEntryVFrame 			      */
 /**********************************************************************/
@@ -57,6 +59,7 @@ class HashEntryVFrame : public FrHashEntry
       char deleted ;
       char undeleted ;
       char locked ;
+      VFramePendingRead *pending ;	// asynchronous read in progress
    //public member functions
       void *operator new(size_t) { return allocator.allocate() ; }
       void operator delete(void *ent) { allocator.release(ent) ; }
@@ -0,0 +1,148 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  FramepaC  -- frame manipulation in C++				*/
+/*  Version 2.01							*/
+/*	by Ralf Brown <ralf@cs.cmu.edu>					*/
+/*									*/
+/*  File frdbbin.h	binary frame records for database files		*/
+/*  LastEdit: 08nov2015							*/
+/*									*/
+/*  (c) Copyright 2015 Ralf Brown/Carnegie Mellon University		*/
+/*	This program is free software; you can redistribute it and/or	*/
+/*	modify it under the terms of the GNU Lesser General Public 	*/
+/*	License as published by the Free Software Foundation, 		*/
+/*	version 3.							*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU Lesser General Public License for more 	*/
+/*	details.							*/
+/*									*/
+/*	You should have received a copy of the GNU Lesser General	*/
+/*	Public License (file COPYING) and General Public License (file	*/
+/*	GPL.txt) along with this program.  If not, see			*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/************************************************************************/
+
+#ifndef __FRDBBIN_H_INCLUDED
+#define __FRDBBIN_H_INCLUDED
+
+#ifndef __FRFRAME_H_INCLUDED
+#include "frframe.h"
+#endif
+
+/**********************************************************************/
+/*	Manifest constants					      */
+/**********************************************************************/
+
+// A binary frame record in the database file consists of
+//	FrDBREC_BINARY
+//	frame name (symbol ID)
+//	number of slots, then for each slot
+//	   slot name (symbol ID)
+//	   number of facets, then for each facet
+//	      facet name (symbol ID)
+//	      number of fillers, then each filler as a tag byte and its data
+// with all counts and IDs stored as variable-length integers (seven bits
+// per byte, low-order first).  Text records always begin with '[', so
+// the first byte tells the two formats apart.
+
+#define FrDBREC_BINARY	0x01
+
+#define FrDBTAG_NIL	0	// null filler
+#define FrDBTAG_SYMBOL	1	// symbol ID
+#define FrDBTAG_INTEGER	2	// zigzag-coded value
+#define FrDBTAG_FLOAT	3	// IEEE bit pattern as stored by FrStore64
+#define FrDBTAG_STRING	4	// char width, length, raw characters
+#define FrDBTAG_LIST	5	// element count, then elements
+#define FrDBTAG_TEXT	6	// length, then printed representation
+
+#define SYMBOLS_SIGNATURE "<<FramepaC Database Symbols>> do not manually edit\n"
+
+class FrDBFillerKeys ;
+
+/**********************************************************************/
+/*	Declaration of class FrDBSymbols			      */
+/**********************************************************************/
+
+// the symbol dictionary of a binary-format database: each distinct symbol
+//   used in any frame record is assigned the next ID the first time it
+//   is written, and its name is appended to the dictionary file.  Names
+//   are never removed, so an aborted transaction merely leaves a few
+//   unused entries behind.
+
+class FrDBSymbols
+   {
+   private:
+      char    *m_names ;		// concatenated NUL-terminated names
+      size_t  *m_offsets ;		// start of each name in m_names
+      FrSymbol **m_symbols ;		// ID -> symbol in owning symtab
+      FrSymbol **m_keys ;		// open-addressed symbol -> ID map
+      uint32_t *m_keyIDs ;
+      size_t   m_namesize ;
+      size_t   m_namealloc ;
+      size_t   m_count ;
+      size_t   m_alloc ;
+      size_t   m_hashsize ;
+      int      m_fd ;
+      bool     m_readonly ;
+      bool     m_dirty ;
+   private:
+      bool expand(size_t namelen) ;
+      void rehash(size_t newsize) ;
+      void insertKey(FrSymbol *sym, uint32_t id) ;
+   public:
+      void *operator new(size_t size) { return FrMalloc(size) ; }
+      void operator delete(void *obj) { FrFree(obj) ; }
+      FrDBSymbols(const char *filename, bool readonly, bool create) ;
+      ~FrDBSymbols() ;
+
+      // accessors
+      bool good() const { return m_fd != -1 ; }
+      size_t size() const { return m_count ; }
+      const char *name(size_t id) const
+	 { return id < m_count ? m_names + m_offsets[id] : 0 ; }
+      FrSymbol *symbol(size_t id) const
+	 { return id < m_count ? m_symbols[id] : 0 ; }
+      long lookup(const FrSymbol *sym) const ;
+
+      // manipulators
+      long intern(const FrSymbol *sym) ;
+      bool flush() ;
+   } ;
+
+/**********************************************************************/
+/**********************************************************************/
+
+// encode 'frame' (or only its name if 'frame' is 0, for a deletion record)
+//   into a newly allocated buffer with 'reserve' bytes left free at the
+//   start for the caller's record header; returns 0 if the dictionary
+//   can't be updated
+char *encode_binary_frame(const FrSymbol *name, const FrFrame *frame,
+			  FrDBSymbols *symbols, size_t reserve,
+			  size_t &length) ;
+
+// return the ID of the frame name stored in a binary record, or -1
+long binary_frame_nameID(const char *record, size_t length) ;
+
+// return the ID of the first filler of the given slot and facet in a
+//   binary record, or -1 if there is none or it is not a symbol; this
+//   neither allocates memory nor consults the dictionary
+long binary_frame_fillerID(const char *record, size_t length, long slotID,
+			   long facetID) ;
+
+// add the filler-index keys (see frdbinv.h) of the fillers stored in a
+//   binary record to 'keys'; returns false if the record is malformed
+bool binary_frame_keys(const char *record, size_t length,
+		       const FrDBSymbols *symbols, FrDBFillerKeys &keys) ;
+
+// add the slots stored in a binary record to 'frame'; returns false if
+//   the record is malformed
+bool decode_binary_frame(FrFrame *frame, const char *record, size_t length,
+			 const FrDBSymbols *symbols) ;
+
+#endif /* !__FRDBBIN_H_INCLUDED */
+
+// end of file frdbbin.h //
@@ -0,0 +1,176 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  FramepaC  -- frame manipulation in C++				*/
+/*  Version 2.01							*/
+/*	by Ralf Brown <ralf@cs.cmu.edu>					*/
+/*									*/
+/*  File frdbinv.h	inverted slot-filler index for database files	*/
+/*  LastEdit: 08nov2015							*/
+/*									*/
+/*  (c) Copyright 2015 Ralf Brown/Carnegie Mellon University		*/
+/*	This program is free software; you can redistribute it and/or	*/
+/*	modify it under the terms of the GNU Lesser General Public 	*/
+/*	License as published by the Free Software Foundation, 		*/
+/*	version 3.							*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU Lesser General Public License for more 	*/
+/*	details.							*/
+/*									*/
+/*	You should have received a copy of the GNU Lesser General	*/
+/*	Public License (file COPYING) and General Public License (file	*/
+/*	GPL.txt) along with this program.  If not, see			*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/************************************************************************/
+
+#ifndef __FRDBINV_H_INCLUDED
+#define __FRDBINV_H_INCLUDED
+
+#ifndef __FRFRAME_H_INCLUDED
+#include "frframe.h"
+#endif
+
+/**********************************************************************/
+/*	Manifest constants					      */
+/**********************************************************************/
+
+// The filler index maps each (slot, facet, filler) triple to the sorted
+//   list of IDs of the frames containing it.  A key consists of the slot
+//   name, a NUL, the facet name, a NUL, the filler's FrDBTAG_ type, and
+//   the filler's value: a symbol's name, an integer in decimal, a float's
+//   IEEE bit pattern, or a string's characters.  Fillers of other types
+//   (and strings of wide characters) are not indexed.  Posting lists store
+//   the first ID and then the gaps between successive IDs as variable-
+//   length integers, so dense lists take about one byte per frame.
+
+#define POSTINGS_SIGNATURE "<<FramepaC Database Postings>> do not manually edit\n"
+
+/**********************************************************************/
+/*	Declaration of class FrDBPostings			      */
+/**********************************************************************/
+
+class FrDBPostings
+   {
+   private:
+      unsigned char *m_data ;
+      uint32_t m_size ;			// bytes in use
+      uint32_t m_alloc ;
+      uint32_t m_count ;		// number of IDs in the list
+      uint32_t m_last ;			// largest ID, for quick appends
+   private:
+      bool splice(size_t pos, size_t oldlen, const unsigned char *bytes,
+		  size_t newlen) ;
+   public:
+      void init() { m_data = 0 ; m_size = m_alloc = m_count = m_last = 0 ; }
+      void free() { FrFree(m_data) ; init() ; }
+
+      // accessors
+      size_t count() const { return m_count ; }
+      size_t bytes() const { return m_size ; }
+      const unsigned char *data() const { return m_data ; }
+      size_t decode(uint32_t *IDs) const ;
+
+      // manipulators
+      bool append(uint32_t ID) ;	// ID must exceed all in the list
+      bool insert(uint32_t ID) ;
+      bool remove(uint32_t ID) ;
+      bool assign(const unsigned char *data, size_t size) ;
+   } ;
+
+/**********************************************************************/
+/*	Declaration of class FrDBFillerKeys			      */
+/**********************************************************************/
+
+// the index keys for the fillers of a single frame
+
+class FrDBFillerKeys
+   {
+   private:
+      char   *m_buffer ;		// concatenated length-prefixed keys
+      size_t  m_size ;
+      size_t  m_alloc ;
+      size_t  m_count ;
+   public:
+      FrDBFillerKeys() { m_buffer = 0 ; m_size = m_alloc = m_count = 0 ; }
+      ~FrDBFillerKeys() { FrFree(m_buffer) ; }
+
+      // accessors
+      size_t count() const { return m_count ; }
+      // return the key at 'pos' and advance 'pos' to the following key,
+      //   or return 0 once all keys have been seen
+      const char *nextKey(size_t &pos, size_t &length) const ;
+
+      // manipulators
+      void clear() { m_size = m_count = 0 ; }
+      bool add(const char *slot, const char *facet, int tag,
+	       const char *value, size_t valuelen) ;
+      bool addFiller(const FrSymbol *slot, const FrSymbol *facet,
+		     const FrObject *filler) ;
+      bool addFrame(const FrFrame *frame) ;
+   } ;
+
+/**********************************************************************/
+/*	Declaration of class FrDBFillerIndex			      */
+/**********************************************************************/
+
+class FrDBFillerIndex
+   {
+   private:
+      char	   **m_keys ;		// length-prefixed key strings
+      FrDBPostings  *m_postings ;	// key ID -> frame IDs
+      FrDBPostings  *m_frames ;		// frame ID -> key IDs
+      uint32_t	    *m_hash ;		// open-addressed key -> key ID + 1
+      size_t	     m_numkeys ;
+      size_t	     m_keyalloc ;
+      size_t	     m_hashsize ;
+      size_t	     m_numframes ;
+      bool	     m_built ;		// do the postings reflect the data?
+      bool	     m_dirty ;		// changed since loaded or saved?
+      bool	     m_transient ;	// never save this index?
+   private:
+      long findKey(const char *key, size_t length) const ;
+      long internKey(const char *key, size_t length) ;
+      void rehash(size_t newsize) ;
+      bool growFrames(uint32_t frameID) ;
+      bool setFrameKeys(uint32_t frameID, const uint32_t *keyIDs,
+			size_t count) ;
+      bool evaluate(const FrList *query, uint32_t *&IDs,
+		    size_t &count) const ;
+      bool lookup(const FrSymbol *slot, const FrSymbol *facet,
+		  const FrObject *filler, uint32_t *&IDs,
+		  size_t &count) const ;
+   public:
+      void *operator new(size_t size) { return FrMalloc(size) ; }
+      void operator delete(void *obj) { FrFree(obj) ; }
+      FrDBFillerIndex() ;
+      ~FrDBFillerIndex() { clear() ; }
+
+      // accessors
+      bool built() const { return m_built ; }
+      bool dirty() const { return m_dirty ; }
+      bool transient() const { return m_transient ; }
+      size_t numKeys() const { return m_numkeys ; }
+
+      // manipulators
+      void clear() ;
+      void markBuilt() { m_built = true ; m_dirty = true ; }
+      void markTransient() { m_transient = true ; }
+      bool updateFrame(long frameID, const FrDBFillerKeys *keys) ;
+
+      // persistence; 'stamp' identifies the state of the data file, and
+      //   load() fails if the saved index was made from another state
+      bool load(const char *filename, long stamp) ;
+      bool save(const char *filename, long stamp) ;
+
+      // queries return a sorted array of frame IDs, allocated with
+      //   FrNewN; a query is (SLOT FILLER), (SLOT FILLER FACET),
+      //   (AND query ...), or (OR query ...)
+      uint32_t *framesMatching(const FrList *query, size_t &count) const ;
+   } ;
+
+#endif /* !__FRDBINV_H_INCLUDED */
+
+// end of file frdbinv.h //
@@ -0,0 +1,245 @@
+/************************************************************************/
+/*									*/
+/*  FramepaC  -- frame manipulation in C++				*/
+/*  Version 2.01							*/
+/*	by Ralf Brown <ralf@cs.cmu.edu>					*/
+/*									*/
+/*  File frfold.h		vectorized case-insensitive comparison	*/
+/*  LastEdit: 08nov2015							*/
+/*									*/
+/*  (c) Copyright 2015 Ralf Brown/Carnegie Mellon University		*/
+/*	This program is free software; you can redistribute it and/or	*/
+/*	modify it under the terms of the GNU Lesser General Public 	*/
+/*	License as published by the Free Software Foundation, 		*/
+/*	version 3.							*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU Lesser General Public License for more 	*/
+/*	details.							*/
+/*									*/
+/*	You should have received a copy of the GNU Lesser General	*/
+/*	Public License (file COPYING) and General Public License (file	*/
+/*	GPL.txt) along with this program.  If not, see			*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/************************************************************************/
+
+#ifndef __FRFOLD_H_INCLUDED
+#define __FRFOLD_H_INCLUDED
+
+#include <stdint.h>
+#include "frcommon.h"
+#include "frctype.h"
+#include "frbytord.h"
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#  include <emmintrin.h>
+#  define FrSIMD_FOLD_WIDTH 16
+#endif
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// patterns at least this long are located with a Horspool skip table
+//   instead of by scanning for their first character
+#define FrFOLD_HORSPOOL_MIN 16
+
+/************************************************************************/
+/************************************************************************/
+
+// the built-in uppercasing tables all fold 'a'-'z' onto 'A'-'Z', leave
+//   every other 7-bit byte alone, and never map an 8-bit byte to or from
+//   a 7-bit one; for those tables, blocks of pure ASCII can be compared
+//   arithmetically, and only blocks containing 8-bit bytes need the table
+inline bool FrCasemapFoldsASCII(const unsigned char *map)
+{
+   return map == FramepaC_toupper_table || map == FramepaC_EUC_toupper_table ;
+}
+
+// search for 'pattern' in 's' ignoring case as given by 'map'; returns the
+//   same result as a byte-by-byte scan, but uses the vectorized kernels
+//   below when 'map' is one of the built-in tables (in frstrut3.C)
+char *FrFoldedSearch(const char *s, const char *pattern,
+		     const unsigned char *map) ;
+
+/************************************************************************/
+/*	Vector kernels							*/
+/************************************************************************/
+
+#ifdef FrSIMD_FOLD_WIDTH
+
+// can we read a full vector at 'p' without risking a step into the next
+//   (possibly unmapped) page?
+inline bool FrFoldBlockSafe(const void *p)
+{
+   return ((uintptr_t)p & 4095) <= 4096 - FrSIMD_FOLD_WIDTH ;
+}
+
+//----------------------------------------------------------------------
+
+// convert the lowercase ASCII letters in a vector of 7-bit bytes to
+//   uppercase
+inline __m128i FrFoldASCII(__m128i bytes)
+{
+   __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(bytes,_mm_set1_epi8('a'-1)),
+				 _mm_cmplt_epi8(bytes,_mm_set1_epi8('z'+1))) ;
+   return _mm_sub_epi8(bytes,_mm_and_si128(lower,_mm_set1_epi8(0x20))) ;
+}
+
+//----------------------------------------------------------------------
+
+// as FrFoldASCII, for a vector of 16-bit characters below 0x80
+inline __m128i FrFoldASCII16(__m128i chars)
+{
+   __m128i lower = _mm_and_si128(_mm_cmpgt_epi16(chars,_mm_set1_epi16('a'-1)),
+				 _mm_cmplt_epi16(chars,_mm_set1_epi16('z'+1)));
+   return _mm_sub_epi16(chars,_mm_and_si128(lower,_mm_set1_epi16(0x20))) ;
+}
+
+#endif /* FrSIMD_FOLD_WIDTH */
+
+//----------------------------------------------------------------------
+
+// count the leading positions (at most N) at which 's1' and 's2' are both
+//   non-NUL and identical after mapping through 'map', which must satisfy
+//   FrCasemapFoldsASCII(); the caller finishes the comparison byte by byte
+//   from that point, so results are identical to a purely scalar loop
+
+inline size_t FrFoldedPrefix(const char *s1, const char *s2, size_t N,
+			     const unsigned char *map)
+{
+   size_t pos = 0 ;
+#ifdef FrSIMD_FOLD_WIDTH
+   const __m128i zero = _mm_setzero_si128() ;
+   for ( ; pos + FrSIMD_FOLD_WIDTH <= N ; pos += FrSIMD_FOLD_WIDTH)
+      {
+      if (!FrFoldBlockSafe(s1+pos) || !FrFoldBlockSafe(s2+pos))
+	 break ;
+      __m128i a = _mm_loadu_si128((const __m128i*)(s1+pos)) ;
+      __m128i b = _mm_loadu_si128((const __m128i*)(s2+pos)) ;
+      if (_mm_movemask_epi8(_mm_or_si128(a,b)) == 0)
+	 {
+	 // pure ASCII, so fold arithmetically
+	 unsigned same = _mm_movemask_epi8(_mm_cmpeq_epi8(FrFoldASCII(a),
+							  FrFoldASCII(b))) ;
+	 unsigned stop = (~same | _mm_movemask_epi8(_mm_cmpeq_epi8(a,zero)))
+	    & 0xFFFF ;
+	 if (stop)
+	    return pos + __builtin_ctz(stop) ;
+	 }
+      else
+	 {
+	 // 8-bit bytes present, so use the table for this block
+	 for (size_t i = pos ; i < pos + FrSIMD_FOLD_WIDTH ; i++)
+	    {
+	    unsigned char c1 = (unsigned char)s1[i] ;
+	    if (c1 == '\0' || map[c1] != map[(unsigned char)s2[i]])
+	       return i ;
+	    }
+	 }
+      }
+#else
+   (void)s1 ; (void)s2 ; (void)N ; (void)map ;
+#endif /* FrSIMD_FOLD_WIDTH */
+   return pos ;
+}
+
+//----------------------------------------------------------------------
+
+// return the first position in 's' holding either a NUL or a byte which
+//   maps to the same value as 'c' under 'map' (which must satisfy
+//   FrCasemapFoldsASCII())
+
+inline const char *FrFoldedScan(const char *s, char c,
+				const unsigned char *map)
+{
+   unsigned char ch = map[(unsigned char)c] ;
+#ifdef FrSIMD_FOLD_WIDTH
+   if (ch < 0x80)
+      {
+      // only the two ASCII cases of a letter (or the byte itself) can
+      //   match, so compare against both; aligned loads never cross
+      //   into another page
+      __m128i v1 = _mm_set1_epi8((char)ch) ;
+      __m128i v2 = _mm_set1_epi8((char)(ch >= 'A' && ch <= 'Z'
+					 ? (ch | 0x20) : ch)) ;
+      __m128i zero = _mm_setzero_si128() ;
+      size_t offset = (uintptr_t)s & (FrSIMD_FOLD_WIDTH - 1) ;
+      const char *block = s - offset ;
+      for ( ; ; block += FrSIMD_FOLD_WIDTH)
+	 {
+	 __m128i bytes = _mm_load_si128((const __m128i*)block) ;
+	 __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes,v1),
+						 _mm_cmpeq_epi8(bytes,v2)),
+				    _mm_cmpeq_epi8(bytes,zero)) ;
+	 unsigned hits = (unsigned)_mm_movemask_epi8(hit) >> offset ;
+	 if (hits)
+	    return block + offset + __builtin_ctz(hits) ;
+	 offset = 0 ;
+	 }
+      }
+#endif /* FrSIMD_FOLD_WIDTH */
+   while (*s && map[(unsigned char)*s] != ch)
+      s++ ;
+   return s ;
+}
+
+//----------------------------------------------------------------------
+
+// count the leading positions (at most N) at which the byte-swapped
+//   16-bit strings 's1' and 's2' are both non-NUL and identical after
+//   Fr_towupper(); blocks of characters below 0x80 are folded
+//   arithmetically, the rest one character at a time
+
+inline size_t FrFoldedPrefix16(const FrChar16 *s1, const FrChar16 *s2,
+			       size_t N)
+{
+   size_t pos = 0 ;
+#ifdef FrSIMD_FOLD_WIDTH
+   if (sizeof(FrChar16) != 2)
+      return 0 ;
+   const size_t width = FrSIMD_FOLD_WIDTH / sizeof(FrChar16) ;
+   const __m128i zero = _mm_setzero_si128() ;
+   const __m128i high = _mm_set1_epi16((short)0xFF80) ;
+   for ( ; pos + width <= N ; pos += width)
+      {
+      if (!FrFoldBlockSafe(s1+pos) || !FrFoldBlockSafe(s2+pos))
+	 break ;
+      __m128i a = _mm_loadu_si128((const __m128i*)(s1+pos)) ;
+      __m128i b = _mm_loadu_si128((const __m128i*)(s2+pos)) ;
+#ifdef FrLITTLEENDIAN
+      a = _mm_or_si128(_mm_slli_epi16(a,8),_mm_srli_epi16(a,8)) ;
+      b = _mm_or_si128(_mm_slli_epi16(b,8),_mm_srli_epi16(b,8)) ;
+#endif /* FrLITTLEENDIAN */
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a,b),
+							   high),
+					    zero)) != 0xFFFF)
+	 {
+	 // non-ASCII characters present, so fold them individually
+	 for (size_t i = pos ; i < pos + width ; i++)
+	    {
+	    if (!s1[i] || (Fr_towupper(FrByteSwap16(s1[i])) !=
+			   Fr_towupper(FrByteSwap16(s2[i]))))
+	       return i ;
+	    }
+	 continue ;
+	 }
+      unsigned same = _mm_movemask_epi8(_mm_cmpeq_epi16(FrFoldASCII16(a),
+							FrFoldASCII16(b))) ;
+      unsigned stop = (~same | _mm_movemask_epi8(_mm_cmpeq_epi16(a,zero)))
+	 & 0xFFFF ;
+      if (stop)
+	 return pos + __builtin_ctz(stop) / sizeof(FrChar16) ;
+      }
+#else
+   (void)s1 ; (void)s2 ; (void)N ;
+#endif /* FrSIMD_FOLD_WIDTH */
+   return pos ;
+}
+
+#endif /* !__FRFOLD_H_INCLUDED */
+
+// end of file frfold.h //
@@ -53,6 +53,10 @@
 
 #define FrNUM_PREDEFINED_SLOTS 4
 
+// frames with more than this many slots (including the predefined ones)
+//   also keep a hash table of their slots
+#define FrSLOT_INDEX_THRESHOLD 16
+
 /**********************************************************************/
 /*    Other types associated with FrFrame			      */
 /**********************************************************************/
@@ -89,6 +93,47 @@ class FrSlot
 	 { next = 0 ; name = slotname ; value_facet = 0 ; other_facets = 0 ; }
    } ;
 
+/**********************************************************************/
+/*    Private class FrSlotIndex					      */
+/**********************************************************************/
+
+// an open-addressed map from slot name to slot, built for frames with many
+//   slots; the frame's linked list of slots remains authoritative (and
+//   determines the order in which slots are visited), so the index only
+//   needs to track slot creation and removal
+
+class FrSlotIndex
+   {
+   private:
+      size_t m_size ;			// number of buckets (power of 2)
+      size_t m_count ;			// number of slots in the index
+      FrSlot *m_slots[1] ;		// actually m_size buckets
+   private:
+      static size_t hashName(const FrSymbol *name, size_t size)
+	 { uintptr_t h = (uintptr_t)name ;
+	   return ((h >> 4) ^ (h >> 13)) & (size - 1) ; }
+      void insertSlot(FrSlot *slot) ;
+   public:
+      // build an index for the 'count' slots on the list 'slots'
+      static FrSlotIndex *create(FrSlot *slots, size_t count) ;
+      static void destroy(FrSlotIndex *index) { FrFree(index) ; }
+
+      // accessors
+      size_t size() const { return m_count ; }
+      bool full() const { return 4 * (m_count + 1) > 3 * m_size ; }
+      FrSlot *find(const FrSymbol *name) const
+	 { size_t pos = hashName(name,m_size) ;
+	   for (FrSlot *slot ; (slot = m_slots[pos]) != 0 ;
+		pos = (pos + 1) & (m_size - 1))
+	      if (slot->name == name)
+		 return slot ;
+	   return 0 ; }
+
+      // manipulators
+      void add(FrSlot *slot) { insertSlot(slot) ; m_count++ ; }
+      void remove(const FrSymbol *name) ;
+   } ;
+
 /************************************************************************/
 /*	Declarations for class FrFrame					*/
 /************************************************************************/
@@ -102,6 +147,7 @@ class FrFrame : public FrObject
       FrSymbol *name ;
       FrSlot *last_slot ;
       FrSlot predef_slots[FrNUM_PREDEFINED_SLOTS] ;
+      FrSlotIndex *slot_index ;		// 0 unless many slots
 #ifdef FrLRU_DISCARD
    public:
       uint32_t LRUclock ;
@@ -117,6 +163,16 @@ class FrFrame : public FrObject
       bool insertInverse(const FrSymbol *slotname, FrSymbol *framename) ;
    protected: // member functions
       void build_empty_frame(FrSymbol *frname) ;
+      FrSlot *findSlot(const FrSymbol *slotname) const
+	 { if (slot_index)
+	      return slot_index->find(slotname) ;
+	   for (const FrSlot *slot = predef_slots ; slot ; slot = slot->next)
+	      if (slot->name == slotname)
+		 return (FrSlot*)slot ;
+	   return 0 ; }
+      void indexSlots(size_t count) ;
+      void dropSlotIndex()
+	 { FrSlotIndex::destroy(slot_index) ; slot_index = 0 ; }
    public: // member functions which should not be called by user code
       void markDirty(bool dirt = true) { dirty = (char)dirt ; }
       void setLock(bool lock = true) { locked = (char)lock ; }
@@ -255,6 +311,16 @@ FrInheritanceType set_inheritance_type(FrInheritanceType inherit) ;
 void set_user_inheritance(FrInheritanceFunc *, FrInheritanceLocFunc *) ;
 void get_user_inheritance(FrInheritanceFunc **, FrInheritanceLocFunc **) ;
 FrInheritanceType get_inheritance_type() ;
+// compile the IS-A and PART-OF hierarchies for isA_p() and partOf_p();
+//   returns the previous setting
+bool use_hierarchy_index(bool enable = true) ;
+// remember the fillers found by inheritance until a relevant filler or
+//   IS-A/PART-OF link changes; returns the previous setting
+bool use_inheritance_cache(bool enable = true, size_t size = 0) ;
+// get the inheritance cache's hit and miss counts; returns false if the
+//   cache is not in use
+bool inheritance_cache_stats(size_t &hits, size_t &misses,
+			     bool reset = false) ;
 
 //----------------------------------------------------------------------
 // procedural interface to FramepaC frame manipulation capabilities
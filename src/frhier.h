@@ -0,0 +1,138 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  FramepaC  -- frame manipulation in C++				*/
+/*  Version 2.01							*/
+/*	by Ralf Brown <ralf@cs.cmu.edu>					*/
+/*									*/
+/*  File frhier.h	compiled IS-A / PART-OF hierarchy index		*/
+/*  LastEdit: 08nov2015							*/
+/*									*/
+/*  (c) Copyright 2015 Ralf Brown/Carnegie Mellon University		*/
+/*	This program is free software; you can redistribute it and/or	*/
+/*	modify it under the terms of the GNU Lesser General Public 	*/
+/*	License as published by the Free Software Foundation, 		*/
+/*	version 3.							*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU Lesser General Public License for more 	*/
+/*	details.							*/
+/*									*/
+/*	You should have received a copy of the GNU Lesser General	*/
+/*	Public License (file COPYING) and General Public License (file	*/
+/*	GPL.txt) along with this program.  If not, see			*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/************************************************************************/
+
+#ifndef __FRHIER_H_INCLUDED
+#define __FRHIER_H_INCLUDED
+
+#ifndef __FRFRAME_H_INCLUDED
+#include "frframe.h"
+#endif
+
+#ifndef __FRSYMTAB_H_INCLUDED
+#include "frsymtab.h"
+#endif
+
+#ifndef __FRPCGLBL_H_INCLUDED
+#include "frpcglbl.h"
+#endif
+
+/**********************************************************************/
+/*	Declaration of class FrHierarchyIndex			      */
+/**********************************************************************/
+
+// the transitive closure of one hierarchy relation (IS-A or PART-OF),
+//   compiled lazily: the first query about a frame collects the names of
+//   all of its ancestors into a sorted array, after which subsumption tests
+//   are a binary search which never touches another frame.  Ancestors'
+//   closures are compiled along the way and reused by their descendants.
+//   An edit to the relation drops just those closures which contain the
+//   edited frame, and a set of every name appearing in any closure lets
+//   the (common) edits which affect no compiled closure return at once.
+
+class FrHierarchyIndex
+   {
+   private:
+      const FrSymbol **m_keys ;		// open-addressed name -> closure map
+      FrSymbol	    ***m_closures ;	// sorted ancestor names per key
+      size_t	      *m_counts ;	// number of ancestors per key
+      size_t	       m_size ;		// capacity of the name map
+      size_t	       m_used ;		// number of compiled closures
+      const FrSymbol **m_members ;	// every name in any closure
+      size_t	       m_membersize ;
+      size_t	       m_memberused ;
+      const FrSymbol **m_active ;	// frames being compiled (cycle check)
+      size_t	       m_depth ;
+      size_t	       m_maxdepth ;
+      bool	       m_partof ;	// PART-OF instead of IS-A?
+   private:
+      size_t find(const FrSymbol *name) const ;
+      bool isMember(const FrSymbol *name) const ;
+      bool addMember(const FrSymbol *name) ;
+      void store(const FrSymbol *name, FrSymbol **closure, size_t count) ;
+      void rehash(size_t newsize) ;
+      bool compile(const FrSymbol *name, bool &cyclic) ;
+      bool compileDFS(const FrSymbol *name) ;
+   public:
+      void *operator new(size_t size) { return FrMalloc(size) ; }
+      void operator delete(void *obj) { FrFree(obj) ; }
+      FrHierarchyIndex(bool partof) ;
+      ~FrHierarchyIndex() ;
+
+      // accessors
+      const FrSymbol *relation() const ;   // in the active symbol table
+      const FrList *parents(const FrFrame *frame) const
+	 { return m_partof ? frame->partOf_list() : frame->isA_list() ; }
+      size_t size() const { return m_used ; }
+
+      // is 'ancestor' reachable from frame 'name' through the relation?
+      //   ('name' itself does not count)
+      bool reaches(const FrSymbol *name, const FrSymbol *ancestor) ;
+
+      // manipulators
+      void frameChanged(const FrSymbol *name) ;
+      void clear() ;
+   } ;
+
+/**********************************************************************/
+/**********************************************************************/
+
+extern FrHierarchyIndex *FramepaC_isa_index ;
+extern FrHierarchyIndex *FramepaC_partof_index ;
+
+// report a change to one VALUE filler of 'slot' in 'frame' ('filler' is 0
+//   if the whole facet changed); changes while frames are being read from
+//   a backing store (which only reveals relations already on file) are
+//   ignored
+void FramepaC_hierarchy_changed(const FrSymbol *frame, const FrSymbol *slot,
+				const FrObject *filler) ;
+// report a change to every slot of 'frame', or to all frames if 0
+void FramepaC_hierarchy_frame_changed(const FrSymbol *frame) ;
+
+inline void FrHierarchyChanged(const FrSymbol *frame, const FrSymbol *slot,
+			       const FrObject *filler = 0)
+{
+   if (FramepaC_isa_index)
+      FramepaC_hierarchy_changed(frame,slot,filler) ;
+}
+
+inline void FrHierarchyChanged(const FrSymbol *frame, const FrSymbol *slot,
+			       const FrSymbol *facet, const FrObject *filler)
+{
+   if (FramepaC_isa_index && facet == symbolVALUE)
+      FramepaC_hierarchy_changed(frame,slot,filler) ;
+}
+
+inline void FrHierarchyFrameChanged(const FrSymbol *frame)
+{
+   if (FramepaC_isa_index)
+      FramepaC_hierarchy_frame_changed(frame) ;
+}
+
+#endif /* !__FRHIER_H_INCLUDED */
+
+// end of file frhier.h //
@@ -0,0 +1,145 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  FramepaC  -- frame manipulation in C++				*/
+/*  Version 2.01							*/
+/*	by Ralf Brown <ralf@cs.cmu.edu>					*/
+/*									*/
+/*  File frinhcch.h	cache of inherited slot fillers			*/
+/*  LastEdit: 08nov2015							*/
+/*									*/
+/*  (c) Copyright 2015 Ralf Brown/Carnegie Mellon University		*/
+/*	This program is free software; you can redistribute it and/or	*/
+/*	modify it under the terms of the GNU Lesser General Public 	*/
+/*	License as published by the Free Software Foundation, 		*/
+/*	version 3.							*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU Lesser General Public License for more 	*/
+/*	details.							*/
+/*									*/
+/*	You should have received a copy of the GNU Lesser General	*/
+/*	Public License (file COPYING) and General Public License (file	*/
+/*	GPL.txt) along with this program.  If not, see			*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/************************************************************************/
+
+#ifndef __FRINHCCH_H_INCLUDED
+#define __FRINHCCH_H_INCLUDED
+
+#ifndef __FRHIER_H_INCLUDED
+#include "frhier.h"
+#endif
+
+/**********************************************************************/
+/*	Manifest constants					      */
+/**********************************************************************/
+
+#define FrINHCACHE_DEFAULT_SIZE	 4096	// entries (rounded to power of 2)
+#define FrINHCACHE_SLOT_GENS	 256	// slot generation counters
+
+/**********************************************************************/
+/*	Declaration of class FrInheritanceCache			      */
+/**********************************************************************/
+
+class FrInheritanceCacheEntry
+   {
+   public:
+      const FrFrame	     *frame ;
+      const FrSymbol	     *slot ;
+      const FrSymbol	     *facet ;
+      _FrFrameInheritanceFunc *method ;
+      const FrList	     *fillers ;	// result (possibly 0) of 'method'
+      size_t		      generation ;
+      size_t		      slot_generation ;
+   } ;
+
+// a direct-mapped memo of the fillers which the inheritance functions
+//   found for (frame,slot,facet,method).  Each entry records the
+//   generation counters in effect when it was filled, and is only used
+//   while they are unchanged: a change to any filler of a slot bumps the
+//   counter which that slot hashes to, while changes to the IS-A,
+//   INSTANCE-OF, or PART-OF links (or the deletion of a frame, whose
+//   fillers the cached lists may point into) bump the global counter and
+//   thus invalidate every entry at once.
+
+class FrInheritanceCache
+   {
+   private:
+      FrInheritanceCacheEntry *m_entries ;
+      size_t	   m_size ;		// number of entries (power of 2)
+      size_t	   m_generation ;
+      size_t	   m_slotgens[FrINHCACHE_SLOT_GENS] ;
+      size_t	   m_hits ;
+      size_t	   m_misses ;
+      size_t	   m_stale ;		// misses on an outdated entry
+   private:
+      static size_t slotIndex(const FrSymbol *slot)
+	 { uintptr_t h = (uintptr_t)slot ;
+	   return ((h >> 4) ^ (h >> 12)) & (FrINHCACHE_SLOT_GENS - 1) ; }
+      size_t entryIndex(const FrFrame *frame, const FrSymbol *slot,
+			const FrSymbol *facet) const ;
+   public:
+      void *operator new(size_t size) { return FrMalloc(size) ; }
+      void operator delete(void *obj) { FrFree(obj) ; }
+      FrInheritanceCache(size_t size = FrINHCACHE_DEFAULT_SIZE) ;
+      ~FrInheritanceCache() ;
+
+      // accessors
+      bool good() const { return m_entries != 0 ; }
+      size_t size() const { return m_size ; }
+      size_t hits() const { return m_hits ; }
+      size_t misses() const { return m_misses ; }
+      size_t staleMisses() const { return m_stale ; }
+
+      // return the fillers 'method' finds for the given slot and facet of
+      //   'frame', calling it only if no current result is cached
+      const FrList *lookup(const FrFrame *frame, const FrSymbol *slot,
+			   const FrSymbol *facet,
+			   _FrFrameInheritanceFunc *method) ;
+
+      // manipulators
+      void slotChanged(const FrSymbol *slot) ;
+      void allChanged() { m_generation++ ; }
+      void resetStats() { m_hits = m_misses = m_stale = 0 ; }
+   } ;
+
+/**********************************************************************/
+/**********************************************************************/
+
+extern FrInheritanceCache *FramepaC_inheritance_cache ;
+
+void FramepaC_inheritance_slot_changed(const FrSymbol *slot) ;
+
+// report a change to one filler (or to the whole facet if 'filler' is 0)
+//   of the given slot of 'frame', for the benefit of the inheritance cache
+//   and the hierarchy index
+inline void FrFillersChanged(const FrSymbol *frame, const FrSymbol *slot,
+			     const FrSymbol *facet, const FrObject *filler)
+{
+   if (FramepaC_inheritance_cache)
+      FramepaC_inheritance_slot_changed(slot) ;
+   FrHierarchyChanged(frame,slot,facet,filler) ;
+}
+
+inline void FrFillersChanged(const FrSymbol *frame, const FrSymbol *slot,
+			     const FrObject *filler = 0)
+{
+   if (FramepaC_inheritance_cache)
+      FramepaC_inheritance_slot_changed(slot) ;
+   FrHierarchyChanged(frame,slot,filler) ;
+}
+
+// report a change to every slot of 'frame' (or to all frames if 0)
+inline void FrFrameChanged(const FrSymbol *frame)
+{
+   if (FramepaC_inheritance_cache)
+      FramepaC_inheritance_cache->allChanged() ;
+   FrHierarchyFrameChanged(frame) ;
+}
+
+#endif /* !__FRINHCCH_H_INCLUDED */
+
+// end of file frinhcch.h //
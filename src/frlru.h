@@ -35,6 +35,9 @@
 #include <limits.h>
 #endif
 
+#include <stddef.h>
+#include <stdint.h>
+
 /**********************************************************************/
 /**********************************************************************/
 
@@ -44,6 +47,90 @@ void initialize_FramepaC_LRU() ;
 void shutdown_FramepaC_LRU() ;
 int discard_LRU_frames() ;
 
+/**********************************************************************/
+/*	Declaration of class FrFrameCache			      */
+/**********************************************************************/
+
+class FrFrame ;
+class FrSymbol ;
+
+struct FrFrameCacheStats
+   {
+   size_t hits ;		// lookups satisfied by a resident frame
+   size_t misses ;		// frames read in from the backing store
+   size_t evictions ;		// frames discarded to stay within budget
+   size_t writebacks ;		// dirty frames committed before eviction
+   size_t resident ;		// frames currently in the cache
+   size_t bytes ;		// their estimated size (if byte-limited)
+   } ;
+
+// tracks the virtual frames resident in memory for one backing store and
+//   discards the least-valuable ones once a frame or byte budget is
+//   exceeded.  Eviction is a segmented CLOCK: new frames start out
+//   probationary and are promoted to the protected segment when the hand
+//   finds they have been used since its last visit; an unused protected
+//   frame is demoted rather than evicted, so frames touched only once
+//   (as during a scan of the database) are the first to go.  Locked
+//   frames, frames marked as visited by a traversal in progress, and
+//   those used within the last FrFRAMECACHE_WINDOW lookups are never
+//   evicted; dirty frames are written back first.  Frames are only
+//   evicted at safe points, never while a frame is being looked up.
+
+#define FrFRAMECACHE_WINDOW 64
+
+class FrFrameCache
+   {
+   private:
+      struct Entry
+	 {
+	 FrSymbol *name ;
+	 FrFrame  *frame ;	// 0 if slot is free
+	 size_t    bytes ;
+	 uint32_t  seen ;	// frame's LRU clock at the hand's last visit
+	 bool      prot ;	// in the protected segment?
+	 } ;
+      Entry  *m_entries ;
+      size_t *m_free ;		// indices of free slots
+      size_t *m_fresh ;	// slots added since the last trim
+      size_t  m_size ;		// slots in use or freed
+      size_t  m_alloc ;
+      size_t  m_numfree ;
+      size_t  m_numfresh ;
+      size_t  m_hand ;
+      size_t  m_protected ;
+      size_t  m_maxframes ;
+      size_t  m_maxbytes ;
+      bool    m_trimming ;
+      FrFrameCacheStats m_stats ;
+   private:
+      void drop(Entry *entry) ;
+      void sizeEntry(Entry *entry) ;
+      bool overBudget() const
+	 { return (m_maxframes && m_stats.resident > m_maxframes) ||
+		  (m_maxbytes && m_stats.bytes > m_maxbytes) ; }
+   public:
+      void *operator new(size_t size) ;
+      void operator delete(void *obj) ;
+      FrFrameCache(size_t max_frames, size_t max_bytes) ;
+      ~FrFrameCache() ;
+
+      // accessors
+      size_t maxFrames() const { return m_maxframes ; }
+      size_t maxBytes() const { return m_maxbytes ; }
+      void getStatistics(FrFrameCacheStats *stats) const ;
+
+      // manipulators
+      void setLimits(size_t max_frames, size_t max_bytes) ;
+      void resetStatistics() ;
+      void hit() { m_stats.hits++ ; }
+      void miss() { m_stats.misses++ ; }
+      bool add(FrFrame *frame) ;
+      // discard frames until back within budget; only call this where
+      //   FramepaC itself holds no frame pointers, such as at the end of
+      //   a user transaction.  Returns the number of frames evicted
+      size_t trim() ;
+   } ;
+
 #endif /* !__FRLRU_H_INCLUDED */
 
 // end of file frlru.h //
@@ -261,11 +261,23 @@ inline VFrame *find_vframe_inline(const FrSymbol *sym)
    register VFrame *fr = (VFrame *)sym->symbolFrame() ;
 
 #ifdef FrLRU_DISCARD
-   if (VFrame_Info &&
-       (fr || (fr = VFrame_Info->retrieveFrame(sym)) != 0))
+   VFrameInfo *info = VFrame_Info ;
+   if (info)
       {
-      // mark frame as most recently accessed
-      fr->setLRUclock(ActiveSymbolTable->LRUclock++) ;
+      FrFrameCache *cache = info->frameCache() ;
+      if (fr)
+	 {
+	 // mark frame as most recently accessed
+	 fr->setLRUclock(ActiveSymbolTable->LRUclock++) ;
+	 if (cache && fr->isVFrame())
+	    cache->hit() ;
+	 }
+      else if ((fr = info->retrieveFrame(sym)) != 0 && cache)
+	 {
+	 // our caller may still be using other frames, so any eviction
+	 //   waits for the next safe point (see FrFrameCache::trim)
+	 cache->miss() ;
+	 }
       }
 #else
    if (!fr && VFrame_Info)
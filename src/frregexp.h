@@ -61,18 +61,22 @@
 /************************************************************************/
 
 class FrRegExElt ;
+class FrRegExDFA ;
 
 class FrRegExp
 {
+   friend class FrRegExpSet ;
    protected:
       FrRegExp *_next ;			// next regex in list
       FrRegExElt *regex ; 		// head node of the current regex
       char *replacement ;
       FrSymbol *_token ;
       FrList *_classes ;		// equivalence classes
+      FrRegExDFA *dfa ;			// compiled automaton, if possible
    public:
       FrRegExp()
-	    { _next = 0 ; regex = 0 ; replacement = 0 ; _token = 0 ; }
+	    { _next = 0 ; regex = 0 ; replacement = 0 ; _token = 0 ;
+	      dfa = 0 ; }
       FrRegExp(const char *re, const char *repl, FrSymbol *token,
 	       FrRegExp *next = 0) ;
       ~FrRegExp() ;
@@ -87,11 +91,68 @@ class FrRegExp
 	    { return word ? match(word->symbolName()) : 0 ; }
       char *replace(char *string) const ;
 
+      // expressions using only characters, sets, strings, and alternations
+      //   of equal-length alternatives are compiled into a DFA by the
+      //   constructor; these allow switching back to the recursive
+      //   matcher, e.g. for comparison
+      bool useAutomaton(bool use = true) ;
+      bool usingAutomaton() const { return dfa != 0 ; }
+
       // access to internal state
       FrRegExp *next() const { return _next ; }
       FrSymbol *token() const { return _token ; }
 } ;
 
+//----------------------------------------------------------------------
+// a prioritized set of regular expressions which are matched against a
+//   word in a single pass over the word by one combined automaton (or a
+//   few, if the combination would grow too large).  Expressions which can't
+//   be matched exactly by an automaton (such as those with class
+//   references) are compiled to accept a superset of their matches, and
+//   are confirmed with FrRegExp::match() only when the automaton accepts.
+
+class FrRegExpSet
+{
+   protected:
+      FrRegExp **m_patterns ;		// in order of decreasing priority
+      unsigned char *m_exact ;		// automaton's decision is final?
+      FrRegExDFA **m_automata ;		// per group; 0 = try each pattern
+      size_t *m_groups ;		// first pattern in each group
+      size_t m_numpatterns ;
+      size_t m_alloc ;
+      size_t m_numgroups ;
+      size_t m_generation ;		// class membership when compiled
+      bool m_compiled ;
+   protected:
+      void clearAutomata() ;
+      void compileGroup(size_t first, size_t past_last) ;
+      bool upToDate() const ;
+   public:
+      FrRegExpSet() ;
+      FrRegExpSet(FrRegExp *patterns) ; // add entire next() chain and compile
+      ~FrRegExpSet() ;		// the FrRegExps are owned by the caller
+
+      // adding a pattern, or a member to one of a pattern's classes, makes
+      //   matching fall back on trying each pattern in turn until the set
+      //   is recompiled
+      bool add(FrRegExp *re) ;
+      bool compile() ;
+
+      // accessors
+      size_t size() const { return m_numpatterns ; }
+      FrRegExp *pattern(size_t N) const { return m_patterns[N] ; }
+      bool compiled() const { return m_compiled ; }
+
+      // return the translation from the highest-priority pattern matching
+      //   the word (the same result as trying each pattern's match() in
+      //   turn), optionally returning that pattern as well
+      FrObject *match(const char *word, FrRegExp **matched = 0) const ;
+      // store up to 'max_matches' of the patterns matching the word in
+      //   'matches', in priority order; returns the number stored
+      size_t matchAll(const char *word, FrRegExp **matches,
+		      size_t max_matches) const ;
+} ;
+
 #endif /* !__FRREGEXP_H_INCLUDED */
 
 // end of file frregexp.h //
@@ -51,6 +51,55 @@ class FrLetterConfusionMatrix
       double score(const char *seq1, const char *seq2) const ;
    } ;
 
+//----------------------------------------------------------------------
+// symmetric-delete index over a good-words table: every entry is stored
+//   under each of the strings formed by deleting up to 'max_distance' of
+//   its letters, so that all entries within that many edits (insertions,
+//   deletions, substitutions, or transpositions of adjacent letters) of a
+//   query share at least one such string with the query's own deletions.
+//   Only hashes of the deletion strings are stored; candidates are
+//   verified by computing the actual edit distance.  With the default
+//   'max_distance' of one, FrSpellingSuggestion(s) returns exactly what
+//   the unindexed search would; with two, it also offers words two edits
+//   away when nothing closer is found (FrSpellingSuggestion only offers
+//   those no longer than the term, so that they fit its buffer).
+
+class FrSpellingIndex
+   {
+   private:
+      char    **m_words ;		// copies of the good-words keys
+      size_t    m_numwords ;
+      uint64_t *m_deletes ;		// (hash << 32) | word number, sorted
+      size_t    m_numdeletes ;
+      size_t   *m_buckets ;		// start of each hash prefix in m_deletes
+      unsigned  m_bucketbits ;
+      size_t    m_maxdist ;
+   protected:
+      bool buildIndex() ;
+   public:
+      FrSpellingIndex(const FrObjHashTable *good_words,
+		      size_t max_distance = 1) ;
+      ~FrSpellingIndex() ;
+
+      // accessors
+      bool OK() const { return m_deletes != 0 || m_numwords == 0 ; }
+      size_t maxDistance() const { return m_maxdist ; }
+      size_t numWords() const { return m_numwords ; }
+      const char *word(size_t N) const { return m_words[N] ; }
+
+      // find all indexed words within 'max_dist' edits of 'term'; returns
+      //   the number found, with their word numbers in ascending order in
+      //   'cands' (free with FrFree) and edit distances in 'dists' (if
+      //   non-NULL, also to be freed with FrFree)
+      size_t candidates(const char *term, size_t max_dist, size_t *&cands,
+			unsigned char **dists = 0) const ;
+
+      // restricted Damerau-Levenshtein distance, or limit+1 if greater
+      //   than 'limit'
+      static size_t editDistance(const char *s1, size_t len1,
+				 const char *s2, size_t len2, size_t limit) ;
+   } ;
+
 //----------------------------------------------------------------------
 
 class FrSpellCorrectionData
@@ -59,16 +108,20 @@ class FrSpellCorrectionData
       FrObjHashTable *m_good_words ;
       const FrSymCountHashTable *m_wordcounts ;
       FrLetterConfusionMatrix *m_confmatrix ;
+      const FrSpellingIndex *m_index ;	// optional; built from m_good_words
    public:
       FrSpellCorrectionData(FrObjHashTable *gw = nullptr,
 			    const FrSymCountHashTable *wc = nullptr,
-			    FrLetterConfusionMatrix *cm = nullptr)
-	 { m_good_words = gw ; m_wordcounts = wc ; m_confmatrix = cm ; }
+			    FrLetterConfusionMatrix *cm = nullptr,
+			    const FrSpellingIndex *idx = nullptr)
+	 { m_good_words = gw ; m_wordcounts = wc ; m_confmatrix = cm ;
+	   m_index = idx ; }
       ~FrSpellCorrectionData()
 	 {
 	 m_good_words = nullptr ;
 	 m_wordcounts = nullptr ;
 	 m_confmatrix = nullptr ; 
+	 m_index = nullptr ;
 	 }
    } ;
 
@@ -89,6 +142,11 @@ FrList *FrSpellingSuggestions(const char *term,
 			      bool allow_normalization = true,
 			      bool allow_self = true) ;
 // return value: list of lists, each containing a suggestion and the corresponding frequency
+// when corr_data has an FrSpellingIndex, the single-edit suggestions are
+//   found via the index rather than by generating and testing every
+//   possible edit (with identical results); if the index allows two edits
+//   and no single-edit suggestion was found, known words two edits away
+//   are suggested with a reduced frequency
 
 #endif /* !__FRSPELL_H_INCLUDED */
 
@@ -449,12 +449,42 @@ FrList *FrCvtString2Wordlist(const char *sentence,
 			      const char *possible_delim /*[256]*/ = 0,
 			      char const * const *abbrevs = 0,
 			      FrCharEncoding = FrChEnc_Latin1) ;
+
 // ditto, but for Unicode characters; if non-zero, 'length' specifies the
 // string's length
 FrList *FrCvtUString2Wordlist(const FrChar16 *sentence, size_t length = 0,
 			       const char *possible_delim /*[256]*/ = 0,
 			       char const * const *abbrevs = 0) ;
 
+// allocation-free tokenization: store the location of each token within
+// 'sentence' in the caller's array, using exactly the same rules as the
+// list-producing functions (FrTokenizeString matches FrCvtString2Wordlist,
+// FrTokenizeSentence matches FrCvtSentence2Wordlist).  Returns the total
+// number of tokens, which may exceed 'max_spans' (in which case only the
+// first 'max_spans' are stored).
+class FrTokenSpan
+   {
+   public:
+      uint32_t offset ;
+      uint32_t length ;
+   } ;
+
+size_t FrTokenizeString(const char *sentence, FrTokenSpan *spans,
+			size_t max_spans,
+			const char *possible_delim /*[256]*/ = 0,
+			char const * const *abbrevs = 0,
+			FrCharEncoding = FrChEnc_Latin1) ;
+size_t FrTokenizeSentence(const char *sentence, FrTokenSpan *spans,
+			  size_t max_spans) ;
+// as above, but store the vocabulary ID of each token (FrVOCAB_WORD_NOT_FOUND
+//   if the token is not in the vocabulary) instead of its location
+size_t FrTokenizeString(const char *sentence, uint32_t *IDs, size_t max_IDs,
+			const class FrVocabulary *vocab,
+			bool force_uppercase = false,
+			const char *possible_delim /*[256]*/ = 0,
+			char const * const *abbrevs = 0,
+			FrCharEncoding = FrChEnc_Latin1) ;
+
 FrList *FrCvtWordlist2Symbollist(const FrList *words,
 				  bool force_uppercase) ;
 FrList *FrCvtWordlist2Symbollist(const FrList *words,
@@ -536,6 +566,24 @@ double FrCognateScore(const FrObject *word1, const FrObject *word2,
 		      bool exact_letter_match_only = false,
 		      FrCognateAlignment **align = 0) ;
 		// if 'align' is nonzero, use delete[] on return val when done
+size_t FrCognateScores(const char *word, const char * const *candidates,
+		       size_t num_candidates, double *scores,
+		       double threshold = 0.0,
+		       bool casefold = true,
+		       bool score_relative_to_shorter = false,
+		       bool score_relative_to_average = false,
+		       bool exact_letter_match_only = false) ;
+size_t FrCognateScores(const FrObject *word, const FrList *candidates,
+		       double *scores, double threshold = 0.0,
+		       bool casefold = true,
+		       bool score_relative_to_shorter = false,
+		       bool score_relative_to_average = false,
+		       bool exact_letter_match_only = false) ;
+		// score 'word' against each candidate, storing the result
+		//   (identical to FrCognateScore) in 'scores'; candidates
+		//   which can't reach 'threshold' are abandoned early and
+		//   get -1.0.  Returns the number of candidates scored
+		//   at or above the threshold.
 
 bool FrWildcardMatch(const char *pattern, const char *str,
 		       bool match_case = true) ;
@@ -544,6 +592,11 @@ bool FrWildcardMatch(const char *pattern, const char *str,
 char **FrLoadAbbreviationList(FILE *fp) ;
 char **FrLoadAbbreviationList(const char *filename) ;
 void FrFreeAbbreviationList(char **abbrevs) ;
+// lists returned by FrLoadAbbreviationList are automatically given a
+//   hashed index for FrIsKnownAbbreviation; other lists may be indexed
+//   explicitly, but must be unindexed before they are freed or modified
+bool FrIndexAbbreviationList(char const * const *abbrevs) ;
+void FrUnindexAbbreviationList(char const * const *abbrevs) ;
 
 // internal support functions
 bool FrIsKnownAbbreviation(const char *start, const char *end,
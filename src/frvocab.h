@@ -73,6 +73,7 @@ class FrVocabulary
       char *m_revindex ;		// reverse index from ID to offset
       char *m_userdata ;		// array of user data
       char *m_words ;			// base of name strings for vocab
+      char *m_hashindex ;		// hash table from name to index entry
 
       size_t m_scalefactor ;		// conv between stored&actual offsets
       size_t m_padmask ;		// used for padding up to next boundary
@@ -88,11 +89,15 @@ class FrVocabulary
       size_t m_words_size ;		// # of bytes in m_words used
       size_t m_words_alloc ;		// # of bytes allocated for m_words
 
+      size_t m_hash_size ;		// # of slots in m_hashindex
+
       bool m_good ;			// valid vocabulary data?
       bool m_readonly ;		// disallow changes to vocab?
       bool m_changed ;		// unsaved updates?
       bool m_mapped ;			// is data memory-mapped?
       bool m_revmapped ;		// is revindex memory-mapped?
+      bool m_hashmapped ;		// is hashindex memory-mapped?
+      bool m_want_hash ;		// maintain m_hashindex across updates?
       bool m_contained ;		// inside another object's memmap?
       bool m_name_is_ID ;
       bool m_batch_update ;
@@ -110,6 +115,9 @@ class FrVocabulary
       bool expandTo(size_t new_alloc) ;
 
       void setIndexEntry(size_t N, size_t wordloc, size_t ID) ;
+      void insertHashEntry(const char *word, size_t N) ;
+      const char *findHashed(const char *word) const ;
+      void dropHashIndex() ;
       const char *getNameFromIndexEntry(size_t N) const ;
 
       size_t addWordName(const char *word) ;
@@ -177,6 +185,12 @@ class FrVocabulary
       // utility funcs & support for indexing
       bool createReverseMapping() ;
       void freeReverseMapping() ;
+      bool createHashIndex() ;
+      void freeHashIndex() ;
+      bool haveHashIndex() const { return m_hashindex != 0 ; }
+      // the hash index makes find() and findID() constant-time; it is kept
+      //   up to date as words are added, and stored by save() after the
+      //   user data.  Files without one fall back on binary search.
       const char **makeWordList() ;
       static void freeWordList(const char **wordlist) ;
    } ;
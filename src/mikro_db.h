@@ -54,6 +54,10 @@
 /**********************************************************************/
 
 class HashEntryVFrame ;
+class FrDBSymbols ;
+class FrDBFillerIndex ;
+class FrFileMapping ;
+class FrThreadPool ;
 
 /**********************************************************************/
 /*	Manifest constants					      */
@@ -65,16 +69,32 @@ class HashEntryVFrame ;
 #  define LOGFILE_EXT_DIGITS "2"
 #  define LOGFILE_EXT_MAX 99
 #  define INDEX_EXTENSION ".dx"
+#  define SYMBOLS_EXTENSION ".sy"
+#  define POSTINGS_EXTENSION ".iv"
 #else
 #  define LOGFILE_EXT ".log"
 #  define LOGFILE_EXT_LEN 7    // ".logNNN"
 #  define LOGFILE_EXT_DIGITS "3"
 #  define LOGFILE_EXT_MAX 999
 #  define INDEX_EXTENSION ".idx"
+#  define SYMBOLS_EXTENSION ".sym"
+#  define POSTINGS_EXTENSION ".inv"
 #endif
 
 #define MAX_ACTIVE_TRANSACTIONS 10
 
+// each record in the data file is preceded by the offset of the frame's
+//   previous version (4 bytes), the record's size (4 bytes), and a
+//   deletion flag
+#define DB_FRAME_HEADER_SIZE 9
+
+// how long (in microseconds) the first of several concurrent transaction
+//   commits waits for the others to join its log write and fsync
+#define DB_COMMIT_WINDOW 0
+
+// how many older versions of each frame an online compaction keeps
+#define DB_COMPACT_GENERATIONS 1
+
 //----------------------------------------------------------------------
 
 #define DB_SIGNATURE "<<FramepaC Database File>> do not manually edit\n"
@@ -84,12 +104,20 @@ class HashEntryVFrame ;
 /**********************************************************************/
 /**********************************************************************/
 
+struct DBLogBatch ;
+struct DBCompaction ;
+
 struct DBFILE
    {
    char *database_name ;
    char *indexfile_name ;
    char *logfile_name ;
    FrSymHashTable *index ;
+   FrDBSymbols *symbols ;	// symbol dictionary for binary frame records
+   FrFileMapping *db_map ;	// data file mapping for map_database_record
+   DBLogBatch *log_batch ;	// log records awaiting a group commit
+   DBCompaction *compaction ;	// online compaction in progress
+   FrDBFillerIndex *fillers ;	// inverted slot-filler index, if any
 #ifdef FrFRAME_ID
    FrameIdentDirectory *frame_IDs ;
 #endif /* FrFRAME_ID */
@@ -106,6 +134,7 @@ struct DBFILE
    int origentrycount ;
    DBUserData user_data ;
    bool readonly ;
+   bool binary_frames ;
    //...
    void *operator new(size_t size) { return FrMalloc(size) ; }
    void operator delete(void *obj) { FrFree(obj) ; }
@@ -130,9 +159,17 @@ int log_frame_delete(DBFILE *db,const FrSymbol *frname) ;
 int start_database_transaction(DBFILE *db) ;
 int end_database_transaction(DBFILE *db,int transaction) ;
 int abort_database_transaction(DBFILE *db,int transaction) ;
+// group commit: while a transaction is active, log records and the syncs
+//   of the files it modifies are deferred until the transaction ends, at
+//   which point they go out as one batched write and a single fsync per
+//   file, shared by any other commits arriving within 'window'
+//   microseconds; enabled by default for databases with a log file
+bool set_group_commit(DBFILE *db, bool enable,
+		      long window = DB_COMMIT_WINDOW) ;
 
 DBFILE *open_database(const char *database, bool createnew = false,
-		      bool transactions = true, const char *password = 0
+		      bool transactions = true, const char *password = 0,
+		      bool binary_frames = false
 #ifdef FrFRAME_ID
 		      ,FrameIdentDirectory *frame_IDs = 0
 #endif /* FrFrameID */
@@ -141,12 +178,47 @@ void load_db_configuration(DBFILE *db) ;
 int update_database_header(DBFILE *db) ;
 
 FrList *find_databases(const char *directory, const char *mask = 0) ;
-char *read_database(DBFILE *db, HashEntryVFrame *entry, bool *deleted = 0) ;
-char *read_old_entry(DBFILE *db, HashEntryVFrame *entry, int generation) ;
+char *read_database(DBFILE *db, HashEntryVFrame *entry, bool *deleted = 0,
+		    long int *size = 0) ;
+char *read_old_entry(DBFILE *db, HashEntryVFrame *entry, int generation,
+		     long int *size = 0) ;
+const char *map_database_record(DBFILE *db, HashEntryVFrame *entry,
+				bool *deleted = 0, long int *size = 0) ;
+const char *map_old_entry(DBFILE *db, HashEntryVFrame *entry, int generation,
+			  long int *size = 0) ;
+void unmap_database_file(DBFILE *db) ;
 bool write_database_entry(DBFILE *db,const FrSymbol *frname) ;
 bool flush_database_file(DBFILE *db) ;
 bool update_database_record(FrHashEntry *ent,DBFILE *db,bool force,bool synch) ;
 int close_database(DBFILE *db) ;
+int convert_database(const char *database, bool binary_frames,
+		     const char *password = 0) ;
+// online compaction: build a new data file holding up to 'generations'
+//   older versions of each frame followed by the current versions, which
+//   are clustered under their IS-A parents, and swap it in for the old
+//   one.  The records are scanned and copied on 'pool' (inline if 0)
+//   while the database remains in use; continue_compaction() returns 0
+//   until that work is done and no transaction is active, then copies
+//   whatever changed in the meantime and swaps the files, returning 1
+//   (or -1 on failure).  compaction_ready() tells whether the next call
+//   will swap the files.
+bool start_compaction(DBFILE *db, int generations = DB_COMPACT_GENERATIONS,
+		      FrThreadPool *pool = 0) ;
+bool compaction_ready(const DBFILE *db) ;
+int continue_compaction(DBFILE *db) ;
+void cancel_compaction(DBFILE *db) ;
+// build a new database from a stream of printed frames in a single pass
+//   (the database must not already exist); when the same frame appears
+//   more than once, the last definition is kept.  Returns the number of
+//   frames stored or -1 on error.
+long int bulk_load_database(const char *database, istream &input,
+			    bool binary_frames = false, FrThreadPool *pool = 0) ;
+// return the sorted IDs of the frames matching 'query' (see
+//   FrDBFillerIndex::framesMatching), building the database's slot-filler
+//   index first if it has not yet been built or loaded.  Frames which have
+//   been modified but not yet stored are matched as stored.
+uint32_t *find_matching_frames(DBFILE *db, const FrList *query,
+			       size_t &count) ;
 
 void set_database_header(DBUserData *user_data) ;
 void FramepaC_select_extra_indexes(bool byslot, bool byfiller, bool byword) ;
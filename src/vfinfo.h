@@ -58,6 +58,7 @@ class VFrameInfo : public FrObject
       VFrameShutdownFunc *shutdown_handler ;
       VFrameProxyFunc *proxyadd_handler, *proxydel_handler ;
    protected: //data
+      FrFrameCache *frame_cache ;	// 0 unless size-limited
       int active_transactions ;
       bool use_transactions ;
    private: // data
@@ -65,8 +66,8 @@ class VFrameInfo : public FrObject
    protected: // methods
       void setReadOnly(bool ro) { readonly = ro ; }
    public:
-      VFrameInfo() { active_transactions = 0 ; }
-      virtual ~VFrameInfo() {}
+      VFrameInfo() { frame_cache = 0 ; active_transactions = 0 ; }
+      virtual ~VFrameInfo() { delete frame_cache ; }
       void *operator new(size_t size) { return FrMalloc(size) ; }
       void operator delete(void *obj) { FrFree(obj) ; }
       virtual FrObjectType objType() const ;
@@ -117,9 +118,16 @@ class VFrameInfo : public FrObject
       bool inTransaction() const
 	    { return (bool)(active_transactions != 0) ; }
       bool isReadOnly() const { return readonly ; }
+      FrFrameCache *frameCache() const { return frame_cache ; }
+      size_t trimFrameCache()
+	    { return frame_cache ? frame_cache->trim() : 0 ; }
+      bool setCacheLimits(size_t max_frames, size_t max_bytes) ;
       FrList *prefixMatches(const char *prefix) const ;
       char *completionFor(const char *prefix) const ;
       virtual int prefetchFrames(FrList *frames) ;
+      virtual bool groupCommit(bool enable, long window) ;
+      virtual int compactDatabase(int generations, bool wait) ;
+      virtual FrList *framesMatching(const FrList *query) const ;
    } ;
 
 
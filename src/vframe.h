@@ -55,7 +55,8 @@ enum BackingStore
    BS_none,
    BS_diskfile,
    BS_server,
-   BS_peer
+   BS_peer,
+   BS_mappedfile
    } ;
 
 struct DBFILE ;
@@ -138,6 +139,20 @@ FrSymbolTable *initialize_VFrames_disk(const char *filename, int symtabsize,
 				       bool transactions = true,
 				       bool force_create = true,
    				       const char *password = 0) ;
+// as initialize_VFrames_disk, but frames are stored in the binary format
+//   and read directly from a memory mapping of the database file
+FrSymbolTable *initialize_VFrames_mapped(const char *filename, int symtabsize,
+					 bool transactions = true,
+					 bool force_create = true,
+					 const char *password = 0) ;
+// rewrite an existing (closed) database in the binary or text format
+bool convert_VFrame_database(const char *dbname, bool binary = true,
+			     const char *password = 0) ;
+// create a new database from a stream of printed frames, such as a dump
+//   of another database, far faster than storing them one at a time;
+//   returns the number of frames stored or -1 on error
+long bulk_load_VFrame_database(const char *dbname, istream &input,
+			       bool binary = false) ;
 FrSymbolTable *initialize_VFrames_server(const char *servername, int port,
 					 const char *username,
 					 const char *password,
@@ -152,6 +167,39 @@ int shutdown_VFrames(FrSymbolTable *symtab = 0) ;
 bool get_DB_user_data(DBUserData *user_data) ;
 bool set_DB_user_data(DBUserData *user_data) ;
 int prefetch_frames(FrList *frames) ;
+// coalesce the log writes and fsyncs of transactions on a disk database
+//   (on by default); concurrent commits arriving within 'window'
+//   microseconds of the first share a single log write and fsync
+bool VFrames_group_commit(bool enable = true, long window = 0) ;
+// rewrite a disk database's data file in the background, keeping up to
+//   'generations' older versions of each frame; call again (or pass
+//   wait=true) to complete the compaction, which returns 1 once the new
+//   file is in use, 0 while still in progress, and -1 on error
+int VFrames_compact(int generations = 1, bool wait = false) ;
+// find the frames in a disk database whose 'slot' has 'filler' in the
+//   given facet (VALUE if omitted), using the database's slot-filler
+//   index, which is built on first use and then kept up to date as
+//   frames are stored; only symbols, numbers, and strings are indexed
+FrList *VFrames_with_filler(const FrSymbol *slot, const FrObject *filler,
+			    const FrSymbol *facet = 0) ;
+// as above, for a query of the form (SLOT FILLER), (SLOT FILLER FACET),
+//   (AND query ...), or (OR query ...); returns the frames' names
+FrList *VFrames_matching(const FrList *query) ;
+// keep at most 'max_frames' virtual frames, and roughly 'max_bytes' of
+//   frame data, in memory for the current database (zero for both means
+//   no limit); frames which have not been used recently are discarded,
+//   after writing back any changes, whenever the limit has been exceeded
+//   at the end of a transaction, in commit_all_frames(), or on a call to
+//   VFrames_trim_cache().  Frames which must stay in memory across those
+//   calls should be locked.
+bool VFrames_set_cache_limit(size_t max_frames, size_t max_bytes = 0) ;
+// discard frames until the cache is back within its limit, such as
+//   periodically while scanning a database outside of transactions;
+//   returns the number discarded
+size_t VFrames_trim_cache() ;
+// retrieve the cache's hit, miss, and eviction counts and current size,
+//   optionally zeroing the counts; returns false if the cache is unlimited
+bool VFrames_cache_statistics(FrFrameCacheStats *stats, bool reset = false) ;
 
 //----------------------------------------------------------------------
 